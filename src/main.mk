@@ -58,6 +58,9 @@ SOURCES      := AS_global.C \
                 stores/gkStoreConstructor.C \
                 stores/gkStoreInfo.C \
                 stores/gkStoreEncode.C \
+                stores/gkStoreBatchReader.C \
+                stores/gkStoreBlock.C \
+                stores/gkStoreColumns.C \
                 stores/gkStorePartition.C \
                 \
                 stores/ovOverlap.C \
@@ -66,6 +69,7 @@ SOURCES      := AS_global.C \
                 stores/ovStoreFilter.C \
                 stores/ovStoreFile.C \
                 stores/ovStoreHistogram.C \
+                stores/ovStoreView.C \
                 \
                 stores/tgStore.C \
                 stores/tgTig.C \
@@ -89,6 +93,7 @@ SOURCES      := AS_global.C \
                 overlapInCore/liboverlap/prefixEditDistance-allocateMoreSpace.C \
                 overlapInCore/liboverlap/prefixEditDistance-extend.C \
                 overlapInCore/liboverlap/prefixEditDistance-forward.C \
+                overlapInCore/liboverlap/prefixEditDistance-matchLength.C \
                 overlapInCore/liboverlap/prefixEditDistance-reverse.C \
                 \
                 overlapInCore/libedlib/edlib.C \
@@ -114,6 +119,7 @@ SOURCES      := AS_global.C \
                 utgcns/libcns/abMultiAlign.C \
                 utgcns/libcns/unitigConsensus.C \
                 utgcns/libpbutgcns/AlnGraphBoost.C  \
+                utgcns/libpbutgcns/AlnGraphFlat.C \
                 \
                 gfa/gfa.C \
                 gfa/bed.C \
@@ -208,6 +214,8 @@ SUBMAKEFILES := stores/dumpBlob.mk \
                 overlapInCore/edalign.mk \
                 \
                 overlapInCore/liboverlap/prefixEditDistance-matchLimitGenerate.mk \
+                overlapInCore/liboverlap/prefixEditDistance-benchmark.mk \
+                overlapInCore/libedlib/edlib-benchmark.mk \
                 \
                 mhap/mhapConvert.mk \
                 \
@@ -231,6 +239,7 @@ SUBMAKEFILES := stores/dumpBlob.mk \
                 \
                 overlapErrorAdjustment/findErrors.mk \
                 overlapErrorAdjustment/findErrors-Dump.mk \
+                overlapErrorAdjustment/findErrors-Merge.mk \
                 overlapErrorAdjustment/correctOverlaps.mk \
                 \
                 bogart/bogart.mk \
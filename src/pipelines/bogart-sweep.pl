@@ -110,6 +110,9 @@ foreach my $cs (@CS) {
 
     system("mkdir -p $path")  if (! -d $path);
 
+    #  The overlap cache snapshot is only reused if -el, -M and -gs all match, so name it by those.  It also
+    #  serves any -eg no higher than the one it was made with; a run with a higher -eg remakes it.
+
     open(F, "> $wrk/$path/bogart.sh") or die "can't open '$wrk/$path/bogart.sh' for writing: $!\n";
     print F "#!/bin/sh\n";
     print F "\n";
@@ -121,6 +124,7 @@ foreach my $cs (@CS) {
     print F "    -O $wrk/$asm.ovlStore \\\n";
     print F "    -T test.tigStore -o test\\\n";
     print F "    -B $b -M $m -threads $t \\\n";
+    print F "    -save -ovlcache $wrk/$asm.ol$oll.M$m.gs$gs.ovlCache \\\n";
     print F "    -gs $gs \\\n";
     print F "    -eg $egl -eb $ebl -em $eml -er $erl -el $ol \\\n";
     print F "    -RS \\\n"  if ($rs eq "-RS");
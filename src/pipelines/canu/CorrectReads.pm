@@ -251,6 +251,7 @@ sub buildCorrectionLayoutsConfigure ($) {
             $cmd .= "  -c " . getCorCov($asm, "Global") . " \\\n";
             $cmd .= "  -l " . getGlobal("corMinEvidenceLength") . " \\\n"  if (defined(getGlobal("corMinEvidenceLength")));
             $cmd .= "  -e " . getGlobal("corMaxEvidenceErate")  . " \\\n"  if (defined(getGlobal("corMaxEvidenceErate")));
+            $cmd .= "  -t " . getNumberOfLocalThreads() . " \\\n";
             $cmd .= "> ./$asm.globalScores.err 2>&1";
 
             if (runCommand($path, $cmd)) {
@@ -297,6 +298,7 @@ sub buildCorrectionLayoutsConfigure ($) {
     $cmd .= "  -eE " . getGlobal("corMaxEvidenceErate")  . " \\\n"  if (defined(getGlobal("corMaxEvidenceErate")));
     $cmd .= "  -ec " . getGlobal("corMinCoverage") . " \\\n";
     $cmd .= "  -eC " . getCorCov($asm, "Local") . " \\\n";
+    $cmd .= "  -t " . getNumberOfLocalThreads() . " \\\n";
     $cmd .= "> ./$asm.corStore.err 2>&1\n";
 
     if (runCommand($base, $cmd)) {
@@ -40,7 +40,7 @@ package canu::Defaults;
 require Exporter;
 
 @ISA    = qw(Exporter);
-@EXPORT = qw(getCommandLineOptions addCommandLineOption addCommandLineError writeLog getNumberOfCPUs getPhysicalMemorySize diskSpace printOptions printHelp printCitation addSequenceFile setParametersFromFile setParametersFromCommandLine checkJava checkGnuplot checkParameters getGlobal setGlobal setGlobalIfUndef setDefaults setVersion);
+@EXPORT = qw(getCommandLineOptions addCommandLineOption addCommandLineError writeLog getNumberOfCPUs getNumberOfLocalThreads getPhysicalMemorySize diskSpace printOptions printHelp printCitation addSequenceFile setParametersFromFile setParametersFromCommandLine checkJava checkGnuplot checkParameters getGlobal setGlobal setGlobalIfUndef setDefaults setVersion);
 
 use strict;
 use Cwd qw(getcwd abs_path);
@@ -271,6 +271,18 @@ sub getNumberOfCPUs () {
 }
 
 
+#  The number of threads a command run on the local machine (not as a job) should use: all of the
+#  CPUs, limited by maxThreads.
+
+sub getNumberOfLocalThreads () {
+    my $thr = getNumberOfCPUs();
+
+    $thr = getGlobal("maxThreads")   if ((defined(getGlobal("maxThreads"))) && (getGlobal("maxThreads") < $thr));
+
+    return($thr);
+}
+
+
 sub getPhysicalMemorySize () {
     my $os     = $^O;
     my $memory = 1;
@@ -889,6 +901,7 @@ sub setDefaults () {
     setDefault("enableOEA",      1,     "Do overlap error adjustment - comprises two steps: read error detection (RED) and overlap error adjustment (OEA); default 'true'");
     setDefault("redBatchSize",   undef, "Number of reads per fragment error detection batch");
     setDefault("redBatchLength", undef, "Number of bases per fragment error detection batch");
+    setDefault("redVoteFraction", 1.0,  "Expected fraction of bases with a disagreeing vote, for sizing fragment error detection batches; default 1.0");
     setDefault("oeaBatchSize",   undef, "Number of reads per overlap error correction batch");
     setDefault("oeaBatchLength", undef, "Number of bases per overlap error correction batch");
 
@@ -116,17 +116,24 @@ sub estimateMemoryNeededForHaplotypeJobs ($) {
     my @haplotypes = getHaplotypes("haplotype");
     my $merSize    = getGlobal("${tag}OvlMerSize");
 
+    #  Every haplotype k-mer set is loaded at once, so sum their sizes.
+
+    my $merBytes = 0;
+
     foreach my $haplotype (@haplotypes) {
-       fetchFile("haplotype/0-mercounts-$haplotype/$haplotype.ms$merSize.only.mcdat");
+        fetchFile("haplotype/0-mercounts-$haplotype/$haplotype.ms$merSize.only.mcdat");
 
-       if (-e "haplotype/0-mercounts-$haplotype/$haplotype.ms$merSize.only.mcdat") {
-          my $size = -s "haplotype/0-mercounts-$haplotype/$haplotype.ms$merSize.only.mcdat";
-          $memEst = int($size / 1073741824.0 + 0.5) * 2;
+        if (-e "haplotype/0-mercounts-$haplotype/$haplotype.ms$merSize.only.mcdat") {
+            $merBytes += -s "haplotype/0-mercounts-$haplotype/$haplotype.ms$merSize.only.mcdat";
         }
-        close(F);
     }
 
-    if ($memEst == 0) {
+    #  Reads are classified in batches of 10000; allow 2 GB for the batch (10000 reads
+    #  of 100 Kbp, sequence and quality) on top of the k-mer sets.
+
+    if ($merBytes > 0) {
+        $memEst = int(2 * $merBytes / 1073741824.0 + 0.999) + 2;
+    } else {
         $memEst = 12;
     }
 
@@ -238,23 +245,21 @@ sub haplotypeConfigure ($) {
         print F "\n";
     }
 
-    print F "\n";
-    print F "\$bin/gatekeeperDumpFASTQ \\\n";
-    print F "  -G \$gkpStore \\\n";
-    print F "  -o ./results/\$jobid.fasta.WORKING \\\n";
-    print F "  -r \$bgn-\$end \\\n";
-    print F "  -fasta -nolibname -noreadname \\\n";
-    print F "  > ./results/\$jobid.err 2>&1 \\\n";
-    print F "&& \\\n";
-    print F "mv ./results/\$jobid.fasta.WORKING.fasta ./results/\$jobid.fasta \\\n";
-    print F "\n";
-
     my @haplotypes = getHaplotypes($base);
     my $merSize    = getGlobal("${tag}OvlMerSize");
-    my $lo         = 0;
-    my $hi         = 1000;
+
+    #  Classify reads and write the fasta for each haplotype.
+
+    print F "\n";
+    print F "\$bin/splitHaplotype \\\n";
+    print F "  -G \$gkpStore \\\n";
+    print F "  -p results/\$jobid \\\n";
+    print F "  -m $merSize \\\n";
 
     foreach my $haplotype (@haplotypes) {
+       my $lo = 0;
+       my $hi = 1000;
+
        fetchFile("$base/0-mercounts-$haplotype/$haplotype.ms$merSize.threshold");
        open(T, "< haplotype/0-mercounts-$haplotype/$haplotype.ms$merSize.threshold") or caExit("can't open haplotype/0-mercounts-$haplotype/$haplotype.ms$merSize.threshold", undef);
        my $rn = <T>;
@@ -263,23 +268,11 @@ sub haplotypeConfigure ($) {
        $hi = $2;
        close(T);
 
-       print F "\$bin/simple-dump \\\n";
-       print F "  -m $merSize \\\n";
-       print F "  -s ../0-mercounts-$haplotype/$haplotype.ms$merSize.only \\\n";
-       print F "  -l $lo -h $hi -f ./results/\$jobid.fasta \\\n";
-       print F "  > ./results/\$jobid.$haplotype.WORKING \\\n";
-       print F "&& \\\n";
-       print F "mv ./results/\$jobid.$haplotype.WORKING ./results/\$jobid.$haplotype \\\n";
-       print F "\n";
+       print F "  -H $haplotype ../0-mercounts-$haplotype/$haplotype.ms$merSize.only $lo $hi \\\n";
     }
-    print F "join results/\$jobid.haplotype* |awk '{print \$1\" \"\$4\" \"\$5\" \"\$8\" \"\$NF}'|awk '{print \$1\" \"\$3/\$2\" \"\$NF/\$(NF-1)}'|awk '{if (\$2 == 0 && \$3 == 0) print \$1\" ambiguous\"; else if (\$2 < \$3) { print \$1\" haplotype2\"; } else if (\$2 > \$3) { print \$1\" haplotype1\"; } else print \$1\" ambiguous\"}'|awk '{print \$NF}'|sort |uniq -c\n";
 
-    # now classify and dump the fasta
-    print F "\$bin/splitHaplotype \\\n";
-    print F "  -G \$gkpStore \\\n";
-    print F "  -p results/\$jobid \\\n";
-    print F "  -h " . join(" ", @haplotypes) . "\\\n";
     print F "  -cr 1 -cl " . getGlobal("minReadLength") . " \\\n";
+    print F "  -t " . getGlobal("corThreads") . " \\\n";
     print F "  -b \$bgn -e \$end \\\n";
     print F "&& \\\n";
     print F "touch ./results/\$jobid.success \\\n";
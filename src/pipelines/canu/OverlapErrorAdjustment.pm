@@ -147,6 +147,9 @@ sub readErrorDetectionConfigure ($) {
     my $maxReads = getGlobal("redBatchSize");
     my $maxBases = getGlobal("redBatchLength");
 
+    my $tallyPerBase = 25 * getGlobal("redVoteFraction");
+    my $perBase      = 1.5 + (($tallyPerBase < 10) ? $tallyPerBase : 10);
+
     print STDERR "--\n";
     print STDERR "-- Configure RED for ", getGlobal("redMemory"), "gb memory.\n";
     print STDERR "--                   Batches of at most ", ($maxReads > 0) ? $maxReads : "(unlimited)", " reads.\n";
@@ -178,10 +181,18 @@ sub readErrorDetectionConfigure ($) {
         #
         #  Per base/vote:
         #    1 byte  for sequence
-        #   12 bytes for Vote_Tally_t
+        #    1/2 byte for confirmed/no_insert counts
+        #   ~25 bytes for each position with a disagreeing vote: a 10 byte Vote_Tally_t and 4 byte
+        #            position in a hash table between 3/8 and 3/4 full.  A read never uses more
+        #            than the 10 bytes per base of a plain array of tallies.
+        #
+        #  Every error in an overlap also votes on the bases next to it, so the fraction of positions
+        #  with a vote (redVoteFraction) is large.  On simulated reads at 30x-50x coverage it was
+        #  0.83-0.98 with 1-2% error (every read ends up as a plain array), and 0.33 with 0.2% error.
+        #  The default of 1.0 assumes the plain array.
         #
         #  Per read:
-        #   32 bytes for Frag_Info_t
+        #   72 bytes for Frag_Info_t
         #
         #  Per olap:
         #   12 bytes for Olap_Info_t
@@ -192,9 +203,12 @@ sub readErrorDetectionConfigure ($) {
         #  could be loaded (done above) and using 2x that (because there are two buffers of these
         #  reads).
         #
+        #  The reads themselves are loaded from gkpStore in chunks of 128 million bases, with the
+        #  next chunk loading while the current one is copied out:  256 MB.
+        #
         #  Throw in another 2 GB for unknown overheads (gkpStore, ovlStore) and alignment generation.
 
-        my $memory = (12 * $bases) + (33 * $reads) + (12 * $olaps) + (2 * $maxBlockSize) + 2 * 1024 * 1024 * 1024;
+        my $memory = ($perBase * $bases) + (73 * $reads) + (12 * $olaps) + (2 * $maxBlockSize) + 256 * 1024 * 1024 + 2 * 1024 * 1024 * 1024;
 
         if ((($maxMem   > 0) && ($memory >= $maxMem))    ||
             (($maxReads > 0) && ($reads  >= $maxReads))  ||
@@ -207,7 +221,7 @@ sub readErrorDetectionConfigure ($) {
                    $memory / 1024 / 1024,
                    $bgn[$nj], $end[$nj],
                    $reads,
-                   $bases,               (12 * $bases + 33 * $reads)  / 1024 / 1024,
+                   $bases,               ($perBase * $bases + 73 * $reads)  / 1024 / 1024,
                    $olaps,               (12 * $olaps)                / 1024 / 1024,
                    2 * $maxBlockSize / 1024 / 1024);
 
@@ -430,6 +444,7 @@ sub overlapErrorAdjustmentConfigure ($) {
     my $maxID    = getNumberOfReadsEarliestVersion($asm);
 
     my $maxMem   = getGlobal("oeaMemory") * 1024 * 1024 * 1024;
+    my $nThreads = getGlobal("oeaThreads");
     my $maxReads = getGlobal("oeaBatchSize");
     my $maxBases = getGlobal("oeaBatchLength");
 
@@ -468,9 +483,11 @@ sub overlapErrorAdjustmentConfigure ($) {
         my $memAdj1   = (8    * $corrSize) * 0.33;    #  Overestimate of the size of the indel adjustments needed (total size includes mismatches)
         my $memReads  = (32   * $reads);              #  Read data in the batch
         my $memOlaps  = (32   * $olaps);              #  Loaded overlaps
-        my $memSeq    = (4    * 2097152);             #  two char arrays of 2*maxReadLen
-        my $memAdj2   = (16   * 2097152);             #  two Adjust_t arrays of maxReadLen
-        my $memWA     = (32   * 1048576);             #  Work area (16mb) and edit array (16mb)
+        #  Each thread has its own sequence and adjustment buffers, and its own work area.
+
+        my $memSeq    = (4    * 2097152) * $nThreads; #  two char arrays of 2*maxReadLen
+        my $memAdj2   = (16   * 2097152) * $nThreads; #  two Adjust_t arrays of maxReadLen
+        my $memWA     = (32   * 1048576) * $nThreads; #  Work area (16mb) and edit array (16mb)
         my $memMisc   = (256  * 1048576);             #  Work area (16mb) and edit array (16mb) and (192mb) slop
         my $memExtra  = (2048 * 1048576);             #  For alignments and overhead.
 
@@ -571,6 +588,7 @@ sub overlapErrorAdjustmentConfigure ($) {
     print F "  -R \$minid \$maxid \\\n";
     print F "  -e " . getGlobal("utgOvlErrorRate") . " -l " . getGlobal("minOverlapLength") . " \\\n";
     print F "  -c ./red.red \\\n";
+    print F "  -t " . getGlobal("oeaThreads") . " \\\n";
     print F "  -o ./\$jobid.oea.WORKING \\\n";
     print F "&& \\\n";
     print F "mv ./\$jobid.oea.WORKING ./\$jobid.oea\n";